@@ -15,6 +15,7 @@ mkdir -p ${OUTPUT}
 make distclean
 make -j2 firmware CORE=${CORE} NETWORK=${NETWORK} BUILD=${BUILD} TMC22XX=${TMC22XX} OUTPUT_NAME=firmware STARTUP_DELAY=${STARTUP_DELAY}
 if [ -f ./build/firmware.bin ]; then
+        sh ./MapReport.sh ./build/firmware.map
         mv ./build/firmware.bin ${OUTPUT}/firmware-${CORE,,}-${NETWORK,,}-${VER,,}.bin
         mv ./build/firmware.map ${OUTPUT}/firmware-${CORE,,}-${NETWORK,,}-${VER,,}.map
 fi 
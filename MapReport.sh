@@ -0,0 +1,74 @@
+#!/bin/sh
+# Summarise memory usage from a linker map file
+# usage: MapReport.sh [mapfile]
+MAP=${1:-build/firmware.map}
+
+if [ ! -f ${MAP} ]; then
+        echo "MapReport: ${MAP} not found"
+        exit 1
+fi
+
+awk '
+function hex(s,    i, c, v) {
+        v = 0
+        s = tolower(s)
+        sub(/^0x/, "", s)
+        for (i = 1; i <= length(s); i++) {
+                c = index("0123456789abcdef", substr(s, i, 1))
+                v = v * 16 + c - 1
+        }
+        return v
+}
+function region(addr,    r) {
+        for (r = 1; r <= nreg; r++)
+                if (addr >= rorg[r] && addr < rorg[r] + rlen[r])
+                        return r
+        return 0
+}
+function section(name, addr, size, load,    r) {
+        if (size == 0 || name ~ /^\.(debug|comment|ARM\.attributes|stack_dummy)/)
+                return
+        r = region(addr)
+        if (r == 0)
+                return
+        used[r] += size
+        printf "  %-20s %-10s %8d\n", name, rname[r], size
+        if (name ~ /ramfunc/)
+                ramcode += size
+        if (load != "" && name !~ /bss|heap|stack/) {
+                r = region(hex(load))
+                if (r != 0)
+                        used[r] += size
+        }
+}
+/^Memory Configuration/ { inmem = 1; next }
+inmem && /^Linker script and memory map/ { inmem = 0; print "Sections:"; next }
+inmem && $1 != "Name" && $1 != "*default*" && NF >= 3 && $2 ~ /^0x/ {
+        nreg++
+        rname[nreg] = $1
+        rorg[nreg] = hex($2)
+        rlen[nreg] = hex($3)
+        next
+}
+inmem { next }
+pending != "" {
+        if ($1 ~ /^0x/ && $2 ~ /^0x/)
+                section(pending, hex($1), hex($2), ($3 == "load") ? $5 : "")
+        pending = ""
+        next
+}
+/PROVIDE \(__AHB0_dyn_start = / { ahbdyn = hex($1) }
+/PROVIDE \(__AHB0_end = / { ahbend = hex($1) }
+/^\.[^ \t]+$/ { pending = $1; next }
+/^\.[^ \t]+[ \t]+0x[0-9a-fA-F]+[ \t]+0x[0-9a-fA-F]+/ {
+        section($1, hex($2), hex($3), ($4 == "load") ? $6 : "")
+}
+END {
+        print "Regions:"
+        for (r = 1; r <= nreg; r++)
+                printf "  %-10s %8d of %8d bytes (%d%%)\n", rname[r], used[r], rlen[r], int(used[r] * 100 / rlen[r])
+        printf "RAM resident code: %d bytes\n", ramcode
+        if (ahbend > ahbdyn)
+                printf "AHB_RAM dynamic: %d bytes free\n", ahbend - ahbdyn
+}
+' ${MAP}
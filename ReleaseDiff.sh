@@ -0,0 +1,37 @@
+#!/bin/sh
+# Compare two firmware images page by page
+# usage: ReleaseDiff.sh old.bin new.bin [pagesize]
+OLD=$1
+NEW=$2
+PAGE=${3:-4096}
+
+if [ ! -f "${OLD}" ] || [ ! -f "${NEW}" ]; then
+        echo "usage: ReleaseDiff.sh old.bin new.bin [pagesize]"
+        exit 1
+fi
+
+OLDSIZE=`wc -c < "${OLD}"`
+NEWSIZE=`wc -c < "${NEW}"`
+
+cmp -l "${OLD}" "${NEW}" 2>/dev/null | awk -v page=${PAGE} -v oldsize=${OLDSIZE} -v newsize=${NEWSIZE} '
+{
+        bytes++
+        p = int(($1 - 1) / page)
+        if (!(p in changed)) {
+                changed[p] = 1
+                pages++
+        }
+}
+END {
+        total = int((newsize + page - 1) / page)
+        # pages of the new image beyond the end of the old one always need sending
+        for (p = int(oldsize / page); newsize > oldsize && p < total; p++) {
+                if (!(p in changed)) {
+                        changed[p] = 1
+                        pages++
+                }
+        }
+        printf "old %d bytes, new %d bytes, %d bytes differ\n", oldsize, newsize, bytes
+        printf "%d of %d pages of %d bytes changed (%d%%), %d bytes to transfer\n", pages, total, page, int(pages * 100 / total), pages * page
+}
+'